@@ -27,9 +27,15 @@
 
 OBJS = \
 	jbistub.obj \
+	jbiarena.obj \
+	jbiprof.obj \
+	jbiserv.obj \
 	jbimain.obj \
 	jbicomp.obj \
-	jbijtag.obj
+	jbijtag.obj \
+	jbivjtag.obj \
+	jbitrace.obj \
+	jbibits.obj
 
 
 !IF "$(MEM_TRACKER)" != ""
@@ -57,19 +63,54 @@ OBJS = \
 jbi.exe : $(OBJS)
 	link $(OBJS) advapi32.lib /out:jbi.exe
 
+# Throughput benchmark on the virtual JTAG chain (no hardware needed)
+bench : jbi.exe
+	jbi.exe -c -b -aCHECK_IDCODE test\top1.jbc
+	jbi.exe -c -b -aPROGRAM -dDO_VERIFY=1 test\top1.jbc
+	jbi.exe -c -b -aCHECK_IDCODE test\top2.jbc
+	jbi.exe -c -b -aPROGRAM -dDO_VERIFY=1 test\top2.jbc
+	jbi.exe -z test\top1.jbc
+	jbi.exe -z test\top2.jbc
+
 # Dependencies:
 
 jbistub.obj : \
 	jbistub.c \
 	jbiport.h \
-	jbiexprt.h
+	jbiexprt.h \
+	jbivjtag.h \
+	jbitrace.h \
+	jbibits.h \
+	jbiarena.h \
+	jbistub.h
+
+jbiarena.obj : \
+	jbiarena.c \
+	jbiarena.h
+
+jbiprof.obj : \
+	jbiprof.c \
+	jbiport.h \
+	jbiexprt.h \
+	jbitrace.h \
+	jbistub.h
+
+jbiserv.obj : \
+	jbiserv.c \
+	jbiport.h \
+	jbiexprt.h \
+	jbivjtag.h \
+	jbitrace.h \
+	jbiarena.h \
+	jbistub.h
 
 jbimain.obj : \
 	jbimain.c \
 	jbiport.h \
 	jbiexprt.h \
 	jbijtag.h \
-	jbicomp.h
+	jbicomp.h \
+	jbibits.h
 
 jamcomp.obj : \
 	jamcomp.c \
@@ -81,4 +122,24 @@ jbijtag.obj : \
 	jbijtag.c \
 	jbiport.h \
 	jbiexprt.h \
-	jbijtag.h
+	jbicomp.h \
+	jbijtag.h \
+	jbibits.h
+
+jbivjtag.obj : \
+	jbivjtag.c \
+	jbiport.h \
+	jbiexprt.h \
+	jbijtag.h \
+	jbivjtag.h
+
+jbitrace.obj : \
+	jbitrace.c \
+	jbiport.h \
+	jbiexprt.h \
+	jbitrace.h
+
+jbibits.obj : \
+	jbibits.c \
+	jbiport.h \
+	jbibits.h